@@ -0,0 +1,56 @@
+#ifndef KINEMATICS_H
+#define KINEMATICS_H
+
+#include <cstddef>
+#include <vector>
+
+// Fixed-target kinematics per nucleon for a projectile hitting a target at rest.
+// Masses are in GeV/c^2, energies in GeV, momenta in GeV/c.
+
+constexpr double kNucleonMass = 0.938;
+
+enum class KinematicsInput
+{
+  kSqrtSNN,   // centre-of-mass energy per nucleon pair
+  kEkin,      // kinetic energy of the projectile in the lab
+  kPlab       // momentum of the projectile in the lab
+};
+
+// Converted quantities, one array per quantity
+struct KinematicsBatch
+{
+  std::vector <double> sqrtSNN;
+  std::vector <double> eLab;      // total energy of the projectile in the lab
+  std::vector <double> tKin;      // kinetic energy of the projectile in the lab
+  std::vector <double> pLab;
+  std::vector <double> pStar;     // momentum of the projectile in the centre-of-mass frame
+  std::vector <double> eStar;     // energy of the projectile in the centre-of-mass frame
+  std::vector <double> yBeam;     // rapidity of the projectile in the centre-of-mass frame
+  std::vector <double> beta;      // velocity of the centre-of-mass frame in the lab
+  std::vector <double> gamma;
+
+  void Resize (size_t n);
+  size_t Size () const { return tKin.size(); }
+};
+
+class Kinematics
+{
+public:
+  Kinematics (double projectileMass = kNucleonMass, double targetMass = kNucleonMass);
+
+  // Fills out with n conversions of values. Inputs below threshold give NaN in every output.
+  void Convert (KinematicsInput input, const double *values, size_t n, KinematicsBatch &out) const;
+  void Convert (KinematicsInput input, const std::vector <double> &values, KinematicsBatch &out) const
+  {
+    Convert (input, values.data(), values.size(), out);
+  }
+
+  double GetProjectileMass () const { return mProjectile; }
+  double GetTargetMass () const { return mTarget; }
+
+private:
+  double mProjectile;
+  double mTarget;
+};
+
+#endif
@@ -0,0 +1,43 @@
+#!/bin/bash
+# Times compareRootFiles with --jobs 1 and --jobs N on synthetic files and checks
+# that both runs give the same ROOT and PDF outputs. Given a build of an older
+# version, also checks that the plotted histograms and graphs keep their style
+# and contents.
+# usage: ./benchmarkJobs.sh [compareRootFiles binary] [objects] [jobs] [baseline binary]
+
+bin=${1:-./build/compareRootFiles}
+nObjects=${2:-5000}
+jobs=${3:-$(nproc)}
+baseline=$4
+macros=$(cd "$(dirname "$0")" && pwd)
+dir=$(mktemp -d)
+inputs="-i $dir/bench_0.root $dir/bench_1.root -l ref new -r"
+
+root -l -b -q "$macros/makeBenchmarkFiles.C($nObjects, \"$dir\")" || exit 1
+
+for j in 1 $jobs; do
+  TIMEFORMAT="--jobs $j: %R s wall, %U s user, %S s system"
+  time "$bin" $inputs -o $dir/jobs_$j.root -j $j > $dir/jobs_$j.log || exit 1
+done
+
+status=0
+root -l -b -q "$macros/compareOutputs.C(\"$dir/jobs_1.root\", \"$dir/jobs_$jobs.root\")" | tee $dir/compare.log
+grep -q "ROOT outputs identical" $dir/compare.log || status=1
+
+# the PDFs differ only by their creation dates
+if cmp -s <(grep -av -e CreationDate -e ModDate $dir/jobs_1.pdf) <(grep -av -e CreationDate -e ModDate $dir/jobs_$jobs.pdf); then
+  echo "PDF outputs identical"
+else
+  echo "PDF outputs differ"
+  status=1
+fi
+
+if [ -n "$baseline" ]; then
+  TIMEFORMAT="baseline: %R s wall, %U s user, %S s system"
+  time "$baseline" $inputs -o $dir/baseline.root > $dir/baseline.log || exit 1
+  root -l -b -q "$macros/compareOutputs.C(\"$dir/baseline.root\", \"$dir/jobs_1.root\", true)" | tee $dir/compare_baseline.log
+  grep -q "ROOT outputs identical" $dir/compare_baseline.log || status=1
+fi
+
+echo "outputs in $dir"
+exit $status